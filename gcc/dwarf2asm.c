@@ -624,7 +624,12 @@ dw2_asm_output_data_uleb128 (unsigned HOST_WIDE_INT value,
 
   if (HAVE_AS_LEB128)
     {
-      fputs ("\t.uleb128 ", asm_out_file);
+      /* A value below 0x80 encodes as that single byte, and the byte
+	 directive is both shorter and cheaper for the assembler.  */
+      if (value < 0x80 && targetm.asm_out.byte_op)
+	fputs (targetm.asm_out.byte_op, asm_out_file);
+      else
+	fputs ("\t.uleb128 ", asm_out_file);
       fprint_whex (asm_out_file, value);
 
       if (flag_debug_asm && comment)
@@ -711,7 +716,15 @@ dw2_asm_output_data_sleb128 (HOST_WIDE_INT value,
 
   if (HAVE_AS_LEB128)
     {
-      fprintf (asm_out_file, "\t.sleb128 " HOST_WIDE_INT_PRINT_DEC, value);
+      /* Likewise for small nonnegative values; see
+	 dw2_asm_output_data_uleb128.  */
+      if (value >= 0 && value < 0x40 && targetm.asm_out.byte_op)
+	{
+	  fputs (targetm.asm_out.byte_op, asm_out_file);
+	  fprint_whex (asm_out_file, value);
+	}
+      else
+	fprintf (asm_out_file, "\t.sleb128 " HOST_WIDE_INT_PRINT_DEC, value);
 
       if (flag_debug_asm && comment)
 	{
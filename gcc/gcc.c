@@ -2900,6 +2900,38 @@ add_sysrooted_prefix (struct path_prefix *pprefix, const char *prefix,
 	      require_machine_suffix, os_multilib);
 }
 
+/* A program found along exec_prefixes by find_a_program.  */
+
+struct program_cache_entry
+{
+  struct program_cache_entry *next;
+  char *name;
+  char *path;
+};
+
+static struct program_cache_entry *program_cache;
+
+/* Search for the program NAME along exec_prefixes, like find_a_file.
+   The same few programs are run for every input file, so remember the
+   result, which must not be freed.  */
+
+static const char *
+find_a_program (const char *name)
+{
+  struct program_cache_entry *p;
+
+  for (p = program_cache; p; p = p->next)
+    if (strcmp (p->name, name) == 0)
+      return p->path;
+
+  p = XNEW (struct program_cache_entry);
+  p->name = xstrdup (name);
+  p->path = find_a_file (&exec_prefixes, name, X_OK, false);
+  p->next = program_cache;
+  program_cache = p;
+  return p->path;
+}
+
 /* Execute the command specified by the arguments on the current line of spec.
    When using pipes, this includes several piped-together commands
    with `|' between them.
@@ -2911,7 +2943,7 @@ execute (void)
 {
   int i;
   int n_commands;		/* # of command.  */
-  char *string;
+  const char *string;
   struct pex_obj *pex;
   struct command
   {
@@ -2926,8 +2958,7 @@ execute (void)
 
   if (wrapper_string)
     {
-      string = find_a_file (&exec_prefixes,
-			    argbuf[0], X_OK, false);
+      string = find_a_program (argbuf[0]);
       if (string)
 	argbuf[0] = string;
       insert_wrapper (wrapper_string);
@@ -2952,7 +2983,7 @@ execute (void)
 
   if (!wrapper_string)
     {
-      string = find_a_file (&exec_prefixes, commands[0].prog, X_OK, false);
+      string = find_a_program (commands[0].prog);
       commands[0].argv[0] = (string) ? string : commands[0].argv[0];
     }
 
@@ -2967,8 +2998,7 @@ execute (void)
 	commands[n_commands].prog = argbuf[i + 1];
 	commands[n_commands].argv
 	  = &(argbuf.address ())[i + 1];
-	string = find_a_file (&exec_prefixes, commands[n_commands].prog,
-			      X_OK, false);
+	string = find_a_program (commands[n_commands].prog);
 	if (string)
 	  commands[n_commands].argv[0] = string;
 	n_commands++;
@@ -3106,9 +3136,6 @@ execute (void)
 	      pfatal_with_name (errmsg);
 	    }
 	}
-
-      if (i && string != commands[i].prog)
-	free (CONST_CAST (char *, string));
     }
 
   execution_count++;
@@ -10080,6 +10107,15 @@ driver::finalize ()
   path_prefix_reset (&startfile_prefixes);
   path_prefix_reset (&include_prefixes);
 
+  while (program_cache)
+    {
+      program_cache_entry *next = program_cache->next;
+      free (program_cache->name);
+      free (program_cache->path);
+      XDELETE (program_cache);
+      program_cache = next;
+    }
+
   machine_suffix = 0;
   just_machine_suffix = 0;
   gcc_exec_prefix = 0;
@@ -3077,6 +3077,19 @@ dt_operand::gen (FILE *f, int indent, bool gimple)
 }
 
 
+/* Generate code counting an applied simplification of the pattern at LOC,
+   so -fdump-statistics shows which patterns fire and how often.  This is
+   emitted right before returning the result, after the transform can no
+   longer fail.  */
+
+static void
+gen_statistics_counter (FILE *f, int indent, source_location loc)
+{
+  fprintf_indent (f, indent, "statistics_counter_event (cfun, \"");
+  output_line_directive (f, loc, true);
+  fprintf (f, "\", 1);\n");
+}
+
 /* Generate code for the '(if ...)', '(with ..)' and actual transform
    step of a '(simplify ...)' or '(match ...)'.  This handles everything
    that is not part of the decision tree (simplify->match).
@@ -3191,10 +3204,11 @@ dt_simplify::gen_1 (FILE *f, int indent, bool gimple, operand *result)
 	}
     }
 
+  /* The location identifying the pattern in the dump and statistics.  */
+  source_location loc = result ? result->location : s->match->location;
   fprintf_indent (f, indent, "if (dump_file && (dump_flags & TDF_DETAILS)) "
 	   "fprintf (dump_file, \"Applying pattern ");
-  output_line_directive (f,
-			 result ? result->location : s->match->location, true);
+  output_line_directive (f, loc, true);
   fprintf (f, ", %%s:%%d\\n\", __FILE__, __LINE__);\n");
 
   if (!result)
@@ -3278,6 +3292,7 @@ dt_simplify::gen_1 (FILE *f, int indent, bool gimple, operand *result)
 	}
       else
 	gcc_unreachable ();
+      gen_statistics_counter (f, indent, loc);
       fprintf_indent (f, indent, "return true;\n");
     }
   else /* GENERIC */
@@ -3328,7 +3343,10 @@ dt_simplify::gen_1 (FILE *f, int indent, bool gimple, operand *result)
 					&cinfo, indexes);
 	    }
 	  if (is_predicate)
-	    fprintf_indent (f, indent, "return true;\n");
+	    {
+	      gen_statistics_counter (f, indent, loc);
+	      fprintf_indent (f, indent, "return true;\n");
+	    }
 	  else
 	    {
 	      fprintf_indent (f, indent, "tree res;\n");
@@ -3393,6 +3411,7 @@ dt_simplify::gen_1 (FILE *f, int indent, bool gimple, operand *result)
 				  i);
 		}
 	    }
+	  gen_statistics_counter (f, indent, loc);
 	  fprintf_indent (f, indent, "return res;\n");
 	}
     }
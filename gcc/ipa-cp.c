@@ -2564,13 +2564,26 @@ devirtualization_time_bonus (struct cgraph_node *node,
 
       /* FIXME: The values below need re-considering and perhaps also
 	 integrating into the cost metrics, at lest in some very basic way.  */
+      int bonus = 0;
       if (isummary->size <= MAX_INLINE_INSNS_AUTO / 4)
-	res += 31 / ((int)speculative + 1);
+	bonus = 31 / ((int)speculative + 1);
       else if (isummary->size <= MAX_INLINE_INSNS_AUTO / 2)
-	res += 15 / ((int)speculative + 1);
+	bonus = 15 / ((int)speculative + 1);
       else if (isummary->size <= MAX_INLINE_INSNS_AUTO
 	       || DECL_DECLARED_INLINE_P (callee->decl))
-	res += 7 / ((int)speculative + 1);
+	bonus = 7 / ((int)speculative + 1);
+
+      /* A call executed many times per invocation, such as a comparison
+	 callback of a sorting routine, benefits from becoming inlinable
+	 each time it is executed.  */
+      if (ie->frequency > CGRAPH_FREQ_BASE)
+	bonus = bonus * MIN (ie->frequency, 8 * CGRAPH_FREQ_BASE)
+		/ CGRAPH_FREQ_BASE;
+      if (dump_file && (dump_flags & TDF_DETAILS))
+	fprintf (dump_file, "     Devirtualization bonus for call %s -> %s "
+		 "with frequency %i: %i\n", node->name (), callee->name (),
+		 ie->frequency, bonus);
+      res += bonus;
     }
 
   return res;
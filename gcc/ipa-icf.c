@@ -1631,15 +1631,24 @@ sem_function::hash_stmt (gimple *stmt, inchash::hash &hstate)
 	      add_type (TREE_TYPE (gimple_assign_rhs3 (stmt)), hstate);
 	    }
 	  add_expr (gimple_assign_lhs (stmt), hstate);
-	  add_type (TREE_TYPE (gimple_assign_lhs (stmt)), two);
+	  add_type (TREE_TYPE (gimple_assign_lhs (stmt)), hstate);
 	  break;
 	}
-      /* fall through */
+      goto hash_ops;
+    case GIMPLE_COND:
+      /* The comparison code is not an operand; without it A < B and
+	 A > B end up in the same class.  */
+      hstate.add_int (gimple_cond_code (stmt));
+      goto hash_ops;
     case GIMPLE_CALL:
+      hstate.add_flag (gimple_call_internal_p (stmt));
+      if (gimple_call_internal_p (stmt))
+	hstate.add_int (gimple_call_internal_fn (stmt));
+      /* fall through */
     case GIMPLE_ASM:
-    case GIMPLE_COND:
     case GIMPLE_GOTO:
     case GIMPLE_RETURN:
+    hash_ops:
       /* All these statements are equivalent if their operands are.  */
       for (unsigned i = 0; i < gimple_num_ops (stmt); ++i)
 	{
@@ -3454,6 +3463,11 @@ sem_item_optimizer::merge_classes (unsigned int prev_class_count)
   unsigned int non_singular_classes_count = 0;
   unsigned int non_singular_classes_sum = 0;
 
+  unsigned int merged_functions = 0;
+  unsigned int merged_variables = 0;
+  unsigned int merged_function_size = 0;
+  unsigned HOST_WIDE_INT merged_variable_bytes = 0;
+
   bool merged_p = false;
 
   /* PR lto/78211
@@ -3559,11 +3573,51 @@ sem_item_optimizer::merge_classes (unsigned int prev_class_count)
 		alias->dump_to_file (dump_file);
 	      }
 
-	    if (dbg_cnt (merged_ipa_icf))
-	      merged_p |= source->merge (alias);
+	    if (!dbg_cnt (merged_ipa_icf))
+	      continue;
+
+	    /* Measure the alias before merging, it may lose its body.  */
+	    unsigned int alias_size = 0;
+	    unsigned HOST_WIDE_INT alias_bytes = 0;
+	    if (alias->type == FUNC)
+	      {
+		if (inline_summaries)
+		  alias_size = inline_summaries->get
+		    (dyn_cast <cgraph_node *> (alias->node))->self_size;
+	      }
+	    else if (DECL_SIZE_UNIT (alias->decl)
+		     && tree_fits_uhwi_p (DECL_SIZE_UNIT (alias->decl)))
+	      alias_bytes = tree_to_uhwi (DECL_SIZE_UNIT (alias->decl));
+
+	    if (source->merge (alias))
+	      {
+		merged_p = true;
+		if (alias->type == FUNC)
+		  {
+		    merged_functions++;
+		    merged_function_size += alias_size;
+		  }
+		else
+		  {
+		    merged_variables++;
+		    merged_variable_bytes += alias_bytes;
+		  }
+	      }
 	  }
       }
 
+  statistics_counter_event (NULL, "ICF merged functions", merged_functions);
+  statistics_counter_event (NULL, "ICF merged variables", merged_variables);
+
+  if (dump_file)
+    {
+      fprintf (dump_file, "Merged functions: %u, estimated size: %u\n",
+	       merged_functions, merged_function_size);
+      fprintf (dump_file, "Merged variables: %u, bytes: "
+	       HOST_WIDE_INT_PRINT_UNSIGNED "\n\n",
+	       merged_variables, merged_variable_bytes);
+    }
+
   return merged_p;
 }
 
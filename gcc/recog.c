@@ -386,6 +386,13 @@ verify_changes (int num)
      we also require that the operands meet the constraints for
      the insn.  */
 
+  /* An earlier call may have validated some of the insns already; reset
+     their codes so that each insn in this range is recognized once,
+     with all the changes in place.  */
+  for (i = num; i < num_changes; i++)
+    if (changes[i].object && !MEM_P (changes[i].object))
+      INSN_CODE (changes[i].object) = -1;
+
   for (i = num; i < num_changes; i++)
     {
       rtx object = changes[i].object;
@@ -395,6 +402,12 @@ verify_changes (int num)
       if (object == 0 || object == last_validated)
 	continue;
 
+      /* A recognized insn was already validated by an earlier,
+	 non-adjacent change in this range.  Do not run recog on it
+	 again.  */
+      if (!MEM_P (object) && INSN_CODE (object) >= 0)
+	continue;
+
       if (MEM_P (object))
 	{
 	  if (! memory_address_addr_space_p (GET_MODE (object),
@@ -34,6 +34,7 @@ along with GCC; see the file COPYING3.  If not see
 #include "ubsan.h"
 #include "params.h"
 #include "tree-hash-traits.h"
+#include "tree-dfa.h"
 #include "gimple-ssa.h"
 #include "tree-phinodes.h"
 #include "ssa-iterators.h"
@@ -84,6 +85,50 @@ maybe_get_single_definition (tree t)
   return NULL_TREE;
 }
 
+/* If PTR is defined as the address of a memory reference at a constant
+   byte offset from an SSA pointer, return that pointer and store the
+   offset to *OFFSET.  Otherwise return NULL_TREE.  */
+
+static tree
+maybe_get_pointer_base_and_offset (tree ptr, HOST_WIDE_INT *offset)
+{
+  tree addr = maybe_get_single_definition (ptr);
+  if (addr == NULL_TREE || TREE_CODE (addr) != ADDR_EXPR)
+    return NULL_TREE;
+
+  HOST_WIDE_INT off;
+  tree base = get_addr_base_and_unit_offset (TREE_OPERAND (addr, 0), &off);
+  if (base == NULL_TREE
+      || TREE_CODE (base) != MEM_REF
+      || TREE_CODE (TREE_OPERAND (base, 0)) != SSA_NAME)
+    return NULL_TREE;
+
+  offset_int moff = mem_ref_offset (base) + off;
+  if (!wi::fits_shwi_p (moff))
+    return NULL_TREE;
+
+  *offset = moff.to_shwi ();
+  return TREE_OPERAND (base, 0);
+}
+
+/* Return the constant byte offset of the address checked by ASAN_CHECK
+   call G relative to KEY, the pointer G has been recorded under in
+   the ASAN_CHECK_MAP.  */
+
+static HOST_WIDE_INT
+asan_check_offset (gimple *g, tree key)
+{
+  tree ptr = gimple_call_arg (g, 1);
+  HOST_WIDE_INT offset;
+
+  if (operand_equal_p (ptr, key, 0))
+    return 0;
+  if (maybe_get_pointer_base_and_offset (ptr, &offset) == key)
+    return offset;
+  /* G has been recorded under the single definition of its pointer.  */
+  return 0;
+}
+
 /* Tree triplet for vptr_check_map.  */
 struct sanopt_tree_triplet
 {
@@ -362,11 +407,13 @@ maybe_optimize_ubsan_vptr_ifn (struct sanopt_ctx *ctx, gimple *stmt)
   return true;
 }
 
-/* Returns TRUE if ASan check of length LEN in block BB can be removed
-   if preceded by checks in V.  */
+/* Returns TRUE if ASan check of length LEN at byte offset OFFSET from KEY
+   in block BB can be removed if preceded by checks in V, the checks
+   recorded for KEY.  */
 
 static bool
-can_remove_asan_check (auto_vec<gimple *> &v, tree len, basic_block bb)
+can_remove_asan_check (auto_vec<gimple *> &v, tree key, HOST_WIDE_INT offset,
+		       tree len, basic_block bb)
 {
   unsigned int i;
   gimple *g;
@@ -389,13 +436,18 @@ can_remove_asan_check (auto_vec<gimple *> &v, tree len, basic_block bb)
 
       tree glen = gimple_call_arg (g, 2);
       gcc_assert (TREE_CODE (glen) == INTEGER_CST);
-
-      /* If we've checked only smaller length than we want to check now,
-	 we can't remove the current stmt.  If g is in the same basic block,
-	 we want to remove it though, as the current stmt is better.  */
-      if (tree_int_cst_lt (glen, len))
+      offset_int gbeg = asan_check_offset (g, key);
+      offset_int gend = gbeg + wi::to_offset (glen);
+      offset_int beg = offset;
+      offset_int end = beg + wi::to_offset (len);
+
+      /* If g hasn't checked the whole range we want to check now, we
+	 can't remove the current stmt.  If g is in the same basic block
+	 and its range is covered by the current one, we want to remove
+	 it though, as the current stmt is better.  */
+      if (wi::lts_p (beg, gbeg) || wi::lts_p (gend, end))
 	{
-	  if (gbb == bb)
+	  if (gbb == bb && wi::les_p (beg, gbeg) && wi::les_p (gend, end))
 	    {
 	      to_pop = g;
 	      cleanup = true;
@@ -460,48 +512,74 @@ maybe_optimize_asan_check_ifn (struct sanopt_ctx *ctx, gimple *stmt)
 
   gimple_set_uid (stmt, info->freeing_call_events);
 
-  auto_vec<gimple *> *ptr_checks = &ctx->asan_check_map.get_or_insert (ptr);
+  ctx->asan_check_map.get_or_insert (ptr);
 
   tree base_addr = maybe_get_single_definition (ptr);
+  if (base_addr)
+    ctx->asan_check_map.get_or_insert (base_addr);
+
+  /* Checks of other constant offsets from the same pointer, e.g. of
+     different fields of one structure, are recorded under that pointer
+     so that a check covering a wider range can make this one
+     redundant.  */
+  HOST_WIDE_INT range_offset = 0;
+  tree range_base = maybe_get_pointer_base_and_offset (ptr, &range_offset);
+  if (range_base)
+    ctx->asan_check_map.get_or_insert (range_base);
+
+  /* Inserting into the map might have invalidated earlier entries.  */
+  auto_vec<gimple *> *ptr_checks = ctx->asan_check_map.get (ptr);
   auto_vec<gimple *> *base_checks = NULL;
+  auto_vec<gimple *> *range_checks = NULL;
   if (base_addr)
-    {
-      base_checks = &ctx->asan_check_map.get_or_insert (base_addr);
-      /* Original pointer might have been invalidated.  */
-      ptr_checks = ctx->asan_check_map.get (ptr);
-    }
+    base_checks = ctx->asan_check_map.get (base_addr);
+  if (range_base)
+    range_checks = ctx->asan_check_map.get (range_base);
 
   gimple *g = maybe_get_dominating_check (*ptr_checks);
   gimple *g2 = NULL;
+  gimple *g3 = NULL;
 
   if (base_checks)
     /* Try with base address as well.  */
     g2 = maybe_get_dominating_check (*base_checks);
 
-  if (g == NULL && g2 == NULL)
+  if (range_checks)
+    g3 = maybe_get_dominating_check (*range_checks);
+
+  if (g == NULL && g2 == NULL && g3 == NULL)
     {
       /* For this PTR we don't have any ASAN_CHECK stmts recorded, so there's
 	 nothing to optimize yet.  */
       ptr_checks->safe_push (stmt);
       if (base_checks)
 	base_checks->safe_push (stmt);
+      if (range_checks)
+	range_checks->safe_push (stmt);
       return false;
     }
 
   bool remove = false;
 
   if (ptr_checks)
-    remove = can_remove_asan_check (*ptr_checks, len, bb);
+    remove = can_remove_asan_check (*ptr_checks, ptr, 0, len, bb);
 
   if (!remove && base_checks)
     /* Try with base address as well.  */
-    remove = can_remove_asan_check (*base_checks, len, bb);
+    remove = can_remove_asan_check (*base_checks, base_addr, 0, len, bb);
+
+  if (!remove && range_checks)
+    /* And with the checks of other offsets from the same pointer.  */
+    remove = can_remove_asan_check (*range_checks, range_base, range_offset,
+				    len, bb);
 
   if (!remove)
     {
       ptr_checks->safe_push (stmt);
       if (base_checks)
 	base_checks->safe_push (stmt);
+      if (range_checks)
+	range_checks->safe_push (stmt);
     }
 
   return remove;
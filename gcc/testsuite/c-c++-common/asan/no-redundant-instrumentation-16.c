@@ -0,0 +1,18 @@
+/* { dg-options "-fdump-tree-sanopt" } */
+/* { dg-do compile } */
+/* { dg-skip-if "" { *-*-* } { "*" } { "-O0" } } */
+
+struct S { int a; int b; };
+
+int
+foo (struct S *p, long long *q)
+{
+  /* One check for the 8 bytes at p, one check for q.  */
+  *q = *(long long *) p;
+  /* No checks here, both fields are covered by the check above.  */
+  return p->a + p->b;
+}
+
+/* { dg-final { scan-tree-dump-times "__builtin___asan_report_load8" 1 "sanopt" } } */
+/* { dg-final { scan-tree-dump-times "__builtin___asan_report_store8" 1 "sanopt" } } */
+/* { dg-final { scan-tree-dump-not "__builtin___asan_report_load4" "sanopt" } } */
@@ -0,0 +1,59 @@
+/* { dg-do run } */
+/* { dg-require-effective-target cilkplus_runtime } */
+/* { dg-options "-fcilkplus" } */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int __cilkrts_set_param (const char *, const char *);
+extern void __cilkrts_get_steal_stats (unsigned long long *,
+				       unsigned long long *,
+				       unsigned long long *);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+void foo(volatile int *);
+
+void main2(void);
+
+int main(void)
+{
+  unsigned long long attempts, steals, idles;
+
+  /* Ensure more than one worker.  */
+  if (__cilkrts_set_param("nworkers", "2") != 0)
+    __builtin_abort();
+
+  main2();
+
+  /* foo only returns once the continuation of its spawn was stolen.  */
+  __cilkrts_get_steal_stats(&attempts, &steals, &idles);
+  if (steals < 1 || attempts < steals)
+    __builtin_abort();
+  return 0;
+}
+
+
+void main2(void)
+{
+  int some_var = 0;
+
+  _Cilk_spawn foo(&some_var);
+
+  some_var=1;
+
+  _Cilk_sync; 
+  return;
+}
+
+void foo(volatile int *some_other_var)
+{
+  while (*some_other_var == 0)
+  {
+   ;
+  }
+}
@@ -0,0 +1,14 @@
+/* { dg-do compile } */
+/* { dg-skip-if "" { *-*-* } { "*" } { "-O0" } } */
+
+int
+foo (int *p, int *q)
+{
+  *p = 1;
+  *q = 2;
+  /* No instrumentation needed, covered by the write above.  */
+  return *p;
+}
+
+/* { dg-final { scan-assembler-times "__tsan_write4" 2 } } */
+/* { dg-final { scan-assembler-not "__tsan_read4" } } */
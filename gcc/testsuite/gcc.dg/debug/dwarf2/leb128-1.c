@@ -0,0 +1,14 @@
+/* LEB128 values that fit in one byte should be emitted with the byte
+   directive rather than .uleb128 or .sleb128.  */
+/* { dg-do compile } */
+/* { dg-options "-O0 -gdwarf" } */
+/* { dg-final { scan-assembler-not "\\.uleb128\[ \t\]+(0|0x\[0-7\]?\[0-9a-f\])\[ \t\n\]" } } */
+/* { dg-final { scan-assembler-not "\\.sleb128\[ \t\]+\[0-9\]\[ \t\n\]" } } */
+
+struct s { int a; char b; long c; };
+
+int
+foo (struct s *p, int x)
+{
+  return p->a + p->b + p->c + x;
+}
@@ -0,0 +1,43 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 -fdump-ipa-icf"  } */
+
+/* Functions differing only in the comparison code of a condition or in
+   the internal function they call must get different hash values, so
+   that each of them starts in a congruence class of its own.  */
+
+extern void g (void);
+
+void
+lt (int a, int b)
+{
+  if (a < b)
+    g ();
+}
+
+void
+gt (int a, int b)
+{
+  if (a > b)
+    g ();
+}
+
+int
+add_ovf (int a, int b)
+{
+  int r;
+  if (__builtin_add_overflow (a, b, &r))
+    g ();
+  return r;
+}
+
+int
+sub_ovf (int a, int b)
+{
+  int r;
+  if (__builtin_sub_overflow (a, b, &r))
+    g ();
+  return r;
+}
+
+/* { dg-final { scan-ipa-dump "Dump after hash based groups\nCongruence classes: 4 \\(unique hash values: 4\\)" "icf"  } } */
+/* { dg-final { scan-ipa-dump "Equal symbols: 0" "icf"  } } */
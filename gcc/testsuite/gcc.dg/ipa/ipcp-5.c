@@ -0,0 +1,35 @@
+/* Test that the devirtualization bonus of an indirect call executed many
+   times per invocation is scaled by its frequency.  */
+/* { dg-do compile } */
+/* { dg-options "-O2 -fdump-ipa-cp-details"  } */
+
+static int
+cb (int x)
+{
+  return x + 1;
+}
+
+static int __attribute__ ((noinline))
+cold (int (*f) (int), int x)
+{
+  return f (x);
+}
+
+static int __attribute__ ((noinline))
+hot (int (*f) (int), int *a, int n)
+{
+  int s = 0;
+  for (int i = 0; i < n; i++)
+    s += f (a[i]);
+  return s;
+}
+
+int
+foo (int *a, int n)
+{
+  return cold (cb, n) + hot (cb, a, n);
+}
+
+/* { dg-final { scan-ipa-dump "Devirtualization bonus for call cold -> cb with frequency 1000: 31\n" "cp"  } } */
+/* { dg-final { scan-ipa-dump "Devirtualization bonus for call hot -> cb with frequency \[0-9\]+: \[0-9\]+\n" "cp"  } } */
+/* { dg-final { scan-ipa-dump-not "Devirtualization bonus for call hot -> cb with frequency \[0-9\]+: 31\n" "cp"  } } */
@@ -0,0 +1,75 @@
+! { dg-do run }
+! Test MAXLOC and MINLOC without DIM or MASK on contiguous integer arrays
+! of rank > 1, which take the library's row-wise fast path, and on a
+! non-contiguous section, which does not.
+program main
+  implicit none
+  integer(kind=1) :: b(3,4)
+  integer(kind=2) :: s(3,4)
+  integer(kind=4) :: a(3,4), c(2,3,4)
+  integer(kind=8) :: d(3,4)
+  integer :: r2(2), r3(3)
+
+  ! Every element is -HUGE-1, the first element is the maximum.
+  a = -huge(a) - 1
+  r2 = maxloc (a)
+  if (any (r2 /= [1, 1])) call abort
+
+  ! The first rows are all -HUGE-1, a later one holds the maximum.
+  a(2,3) = 5
+  r2 = maxloc (a)
+  if (any (r2 /= [2, 3])) call abort
+
+  ! The maximum is repeated across rows, the first one in array element
+  ! order is returned.
+  a = 0
+  a(3,2) = 7
+  a(1,4) = 7
+  a(2,4) = 7
+  r2 = maxloc (a)
+  if (any (r2 /= [3, 2])) call abort
+
+  ! Same on a non-contiguous section.
+  r2 = maxloc (a(1:3:2,:))
+  if (any (r2 /= [2, 2])) call abort
+
+  a = huge(a)
+  r2 = minloc (a)
+  if (any (r2 /= [1, 1])) call abort
+  a(2,2) = -3
+  a(1,3) = -3
+  r2 = minloc (a)
+  if (any (r2 /= [2, 2])) call abort
+
+  c = -huge(c) - 1
+  r3 = maxloc (c)
+  if (any (r3 /= [1, 1, 1])) call abort
+  c(2,1,3) = 9
+  c(1,2,3) = 9
+  r3 = maxloc (c)
+  if (any (r3 /= [2, 1, 3])) call abort
+
+  b = -huge(b) - 1_1
+  r2 = maxloc (b)
+  if (any (r2 /= [1, 1])) call abort
+  b(1,2) = 1
+  b(3,1) = 1
+  r2 = maxloc (b)
+  if (any (r2 /= [3, 1])) call abort
+
+  s = huge(s)
+  r2 = minloc (s)
+  if (any (r2 /= [1, 1])) call abort
+  s(2,4) = -1
+  s(3,3) = -1
+  r2 = minloc (s)
+  if (any (r2 /= [3, 3])) call abort
+
+  d = -huge(d) - 1_8
+  r2 = maxloc (d)
+  if (any (r2 /= [1, 1])) call abort
+  d(1,4) = 2
+  d(2,2) = 2
+  r2 = maxloc (d)
+  if (any (r2 /= [2, 2])) call abort
+end program main
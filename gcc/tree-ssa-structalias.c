@@ -2758,20 +2758,37 @@ solve_graph (constraint_graph_t graph)
 		  unsigned eff_escaped_id = find (escaped_id);
 
 		  /* Propagate solution to all successors.  */
+		  unsigned to_remove = ~0U;
 		  EXECUTE_IF_IN_NONNULL_BITMAP (graph->succs[i],
 						0, j, bi)
 		    {
 		      bitmap tmp;
 		      bool flag;
 
+		      if (to_remove != ~0U)
+			{
+			  bitmap_clear_bit (graph->succs[i], to_remove);
+			  to_remove = ~0U;
+			}
 		      unsigned int to = find (j);
-		      tmp = get_varinfo (to)->solution;
-		      flag = false;
+		      if (to != j)
+			{
+			  /* Lazily redirect the edge to the representative
+			     of the collapsed node, so later iterations do
+			     not visit it again.  The old bit is cleared
+			     only after the iterator moved past it.  */
+			  to_remove = j;
+			  if (!bitmap_set_bit (graph->succs[i], to))
+			    continue;
+			}
 
 		      /* Don't try to propagate to ourselves.  */
 		      if (to == i)
 			continue;
 
+		      tmp = get_varinfo (to)->solution;
+		      flag = false;
+
 		      /* If we propagate from ESCAPED use ESCAPED as
 		         placeholder.  */
 		      if (i == eff_escaped_id)
@@ -2782,6 +2799,8 @@ solve_graph (constraint_graph_t graph)
 		      if (flag)
 			bitmap_set_bit (changed, to);
 		    }
+		  if (to_remove != ~0U)
+		    bitmap_clear_bit (graph->succs[i], to_remove);
 		}
 	    }
 	}
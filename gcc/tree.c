@@ -9599,6 +9599,71 @@ get_call_combined_fn (const_tree call)
 
 #define TREE_MEM_USAGE_SPACES 40
 
+/* Print how many of the declarations known to the symbol table, and of
+   the parameters of the functions among them, have some of the rarely
+   set pointer fields of their nodes filled in.  */
+
+static void
+print_decl_field_statistics (void)
+{
+  unsigned int fndecls = 0, vardecls = 0, parmdecls = 0;
+  unsigned int asm_names = 0, origins = 0, attributes = 0;
+  unsigned int personalities = 0, target_opts = 0, optimize_opts = 0;
+  unsigned int vindexes = 0, parm_origins = 0, parm_attributes = 0;
+  symtab_node *node;
+
+  if (!symtab)
+    return;
+
+  FOR_EACH_SYMBOL (node)
+    {
+      tree decl = node->decl;
+
+      if (DECL_ASSEMBLER_NAME_SET_P (decl))
+	asm_names++;
+      if (DECL_ABSTRACT_ORIGIN (decl))
+	origins++;
+      if (DECL_ATTRIBUTES (decl))
+	attributes++;
+
+      if (TREE_CODE (decl) != FUNCTION_DECL)
+	{
+	  vardecls++;
+	  continue;
+	}
+
+      fndecls++;
+      if (DECL_FUNCTION_PERSONALITY (decl))
+	personalities++;
+      if (DECL_FUNCTION_SPECIFIC_TARGET (decl))
+	target_opts++;
+      if (DECL_FUNCTION_SPECIFIC_OPTIMIZATION (decl))
+	optimize_opts++;
+      if (DECL_VINDEX (decl))
+	vindexes++;
+
+      for (tree parm = DECL_ARGUMENTS (decl); parm; parm = DECL_CHAIN (parm))
+	{
+	  parmdecls++;
+	  if (DECL_ABSTRACT_ORIGIN (parm))
+	    parm_origins++;
+	  if (DECL_ATTRIBUTES (parm))
+	    parm_attributes++;
+	}
+    }
+
+  fprintf (stderr, "Decl fields in use for %u functions, %u variables:\n",
+	   fndecls, vardecls);
+  fprintf (stderr, "  assembler name %u, abstract origin %u, attributes %u\n",
+	   asm_names, origins, attributes);
+  fprintf (stderr, "  personality %u, target options %u, "
+	   "optimization options %u, vindex %u\n",
+	   personalities, target_opts, optimize_opts, vindexes);
+  fprintf (stderr, "Decl fields in use for %u parameters:\n", parmdecls);
+  fprintf (stderr, "  abstract origin %u, attributes %u\n",
+	   parm_origins, parm_attributes);
+}
+
 /* Print debugging information about tree nodes generated during the compile,
    and any language-specific information.  */
 
@@ -9640,6 +9705,7 @@ dump_tree_statistics (void)
   print_type_hash_statistics ();
   print_debug_expr_statistics ();
   print_value_expr_statistics ();
+  print_decl_field_statistics ();
   lang_hooks.print_statistics ();
 }
 
@@ -90,6 +90,32 @@ is_vptr_store (gimple *stmt, tree expr, bool is_write)
   return NULL;
 }
 
+/* Return true if BASE, a MEM_REF or TARGET_MEM_REF, dereferences a pointer
+   that according to points-to analysis can only point to local variables
+   or heap objects that do not escape the current function.  Such memory
+   can't be shared with other threads.  */
+
+static bool
+deref_of_nonescaping_p (tree base)
+{
+  tree ptr = TREE_OPERAND (base, 0);
+  if (TREE_CODE (ptr) != SSA_NAME)
+    return false;
+
+  struct ptr_info_def *pi = SSA_NAME_PTR_INFO (ptr);
+  if (pi == NULL)
+    return false;
+
+  struct pt_solution *pt = &pi->pt;
+  return !(pt->anything
+	   || pt->nonlocal
+	   || pt->escaped
+	   || pt->ipa_escaped
+	   || pt->vars_contains_nonlocal
+	   || pt->vars_contains_escaped
+	   || pt->vars_contains_escaped_heap);
+}
+
 /* Instruments EXPR if needed. If any instrumentation is inserted,
    return true.  */
 
@@ -129,7 +155,16 @@ instrument_expr (gimple_stmt_iterator gsi, tree expr, bool is_write)
 	return false;
     }
 
-  if (TREE_READONLY (base) || (VAR_P (base) && DECL_HARD_REGISTER (base)))
+  /* Likewise for memory only reachable through pointers to such decls
+     or to non-escaping heap objects.  */
+  if ((TREE_CODE (base) == MEM_REF || TREE_CODE (base) == TARGET_MEM_REF)
+      && deref_of_nonescaping_p (base))
+    return false;
+
+  /* Read-only data can't race.  */
+  if (TREE_READONLY (base)
+      || CONSTANT_CLASS_P (base)
+      || (VAR_P (base) && DECL_HARD_REGISTER (base)))
     return false;
 
   stmt = gsi_stmt (gsi);
@@ -689,17 +724,66 @@ instrument_builtin_call (gimple_stmt_iterator *gsi)
       }
 }
 
+/* Maximum number of accesses remembered per basic block for the purpose
+   of eliding redundant instrumentation.  */
+#define TSAN_MAX_BB_ACCESSES 32
+
+/* A memory access instrumented in the current basic block.  */
+
+struct tsan_access
+{
+  tree expr;
+  bool is_write;
+};
+
+/* Return true if an access to EXPR, a store if IS_WRITE, needs no
+   instrumentation because the same thread has already accessed the same
+   location in the current basic block with no statement that might
+   synchronize with other threads in between.  A previous write covers
+   both reads and writes, a previous read only covers reads.  ACCESSES
+   holds the accesses seen so far.  */
+
+static bool
+tsan_redundant_access_p (vec<tsan_access> *accesses, tree expr, bool is_write)
+{
+  unsigned int i;
+  tsan_access *a;
+
+  FOR_EACH_VEC_ELT (*accesses, i, a)
+    if ((a->is_write || !is_write)
+	&& operand_equal_p (a->expr, expr, 0))
+      return true;
+  return false;
+}
+
+/* Record an access to EXPR in ACCESSES.  */
+
+static void
+tsan_record_access (vec<tsan_access> *accesses, tree expr, bool is_write)
+{
+  if (accesses->length () >= TSAN_MAX_BB_ACCESSES)
+    return;
+  tsan_access a = { expr, is_write };
+  accesses->safe_push (a);
+}
+
 /* Instruments the gimple pointed to by GSI. Return
-   true if func entry/exit should be instrumented.  */
+   true if func entry/exit should be instrumented.  ACCESSES holds the
+   accesses already instrumented in the current basic block.  */
 
 static bool
-instrument_gimple (gimple_stmt_iterator *gsi)
+instrument_gimple (gimple_stmt_iterator *gsi, vec<tsan_access> *accesses)
 {
   gimple *stmt;
   tree rhs, lhs;
   bool instrumented = false;
 
   stmt = gsi_stmt (*gsi);
+
+  /* Calls and asms might synchronize with other threads.  */
+  if (is_gimple_call (stmt) || gimple_code (stmt) == GIMPLE_ASM)
+    accesses->truncate (0);
+
   if (is_gimple_call (stmt)
       && (gimple_call_fndecl (stmt)
 	  != builtin_decl_implicit (BUILT_IN_TSAN_INIT)))
@@ -715,15 +799,26 @@ instrument_gimple (gimple_stmt_iterator *gsi)
   else if (is_gimple_assign (stmt)
 	   && !gimple_clobber_p (stmt))
     {
+      bool elide = !gimple_has_volatile_ops (stmt);
       if (gimple_store_p (stmt))
 	{
 	  lhs = gimple_assign_lhs (stmt);
-	  instrumented = instrument_expr (*gsi, lhs, true);
+	  if (!elide || !tsan_redundant_access_p (accesses, lhs, true))
+	    {
+	      instrumented = instrument_expr (*gsi, lhs, true);
+	      if (instrumented && elide)
+		tsan_record_access (accesses, lhs, true);
+	    }
 	}
       if (gimple_assign_load_p (stmt))
 	{
 	  rhs = gimple_assign_rhs1 (stmt);
-	  instrumented = instrument_expr (*gsi, rhs, false);
+	  if (!elide || !tsan_redundant_access_p (accesses, rhs, false))
+	    {
+	      instrumented = instrument_expr (*gsi, rhs, false);
+	      if (instrumented && elide)
+		tsan_record_access (accesses, rhs, false);
+	    }
 	}
     }
   return instrumented;
@@ -781,9 +876,11 @@ instrument_memory_accesses (bool *cfg_changed)
   bool fentry_exit_instrument = false;
   bool func_exit_seen = false;
   auto_vec<gimple *> tsan_func_exits;
+  auto_vec<tsan_access, TSAN_MAX_BB_ACCESSES> accesses;
 
   FOR_EACH_BB_FN (bb, cfun)
     {
+      accesses.truncate (0);
       for (gsi = gsi_start_bb (bb); !gsi_end_p (gsi); gsi_next (&gsi))
 	{
 	  gimple *stmt = gsi_stmt (gsi);
@@ -796,7 +893,7 @@ instrument_memory_accesses (bool *cfg_changed)
 	      func_exit_seen = true;
 	    }
 	  else
-	    fentry_exit_instrument |= instrument_gimple (&gsi);
+	    fentry_exit_instrument |= instrument_gimple (&gsi, &accesses);
 	}
       if (gimple_purge_dead_eh_edges (bb))
 	*cfg_changed = true;
@@ -227,6 +227,21 @@ CILK_API(int) __cilkrts_get_worker_number(void);
  */
 CILK_API(int) __cilkrts_get_force_reduce(void);
 
+/** Returns work-stealing statistics summed over all workers.
+ *
+ *  The counts are maintained regardless of how the runtime was built.
+ *  Since the workers keep running while the counts are read, the result is
+ *  only a snapshot.
+ *
+ *  @param attempts Receives the number of steal attempts.
+ *  @param steals   Receives the number of successful steals.
+ *  @param idles    Receives the number of times a worker idled after
+ *                  failing to steal.
+ */
+CILK_API(void) __cilkrts_get_steal_stats(unsigned long long *attempts,
+                                         unsigned long long *steals,
+                                         unsigned long long *idles);
+
 /** Interacts with tools
  */
 CILK_API(void)
@@ -402,6 +417,8 @@ __CILKRTS_END_EXTERN_C
 #define __cilkrts_get_total_workers() (1)
 #define __cilkrts_get_worker_number() (0)
 #define __cilkrts_get_force_reduce() (0)
+#define __cilkrts_get_steal_stats(attempts,steals,idles) \
+    ((void) (*(attempts) = *(steals) = *(idles) = 0))
 #define __cilkrts_metacall(tool,code,data) ((tool), (code), (data), 0)
 
 #if __CILKRTS_ABI_VERSION >= 1
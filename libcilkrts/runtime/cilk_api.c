@@ -117,6 +117,33 @@ CILK_API_INT __cilkrts_get_force_reduce(void)
     return cilkg_get_force_reduce();
 }
 
+CILK_API_VOID
+__cilkrts_get_steal_stats(unsigned long long *attempts,
+                          unsigned long long *steals,
+                          unsigned long long *idles)
+{
+    int i;
+    *attempts = *steals = *idles = 0;
+
+    // Take out the global OS mutex so that the workers cannot be
+    // deallocated while we read their counters.
+    global_os_mutex_lock();
+
+    if (cilkg_is_published()) {
+        global_state_t *g = cilkg_get_global_state();
+        for (i = 0; g->workers && i < g->total_workers; ++i) {
+            __cilkrts_worker *w = g->workers[i];
+            if (w && w->l) {
+                *attempts += w->l->steal_attempts;
+                *steals += w->l->steals;
+                *idles += w->l->idles;
+            }
+        }
+    }
+
+    global_os_mutex_unlock();
+}
+
 CILK_API_INT __cilkrts_set_param(const char* param, const char* value)
 {
     return cilkg_set_param(param, value);
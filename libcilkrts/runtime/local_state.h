@@ -376,6 +376,26 @@ struct local_state  /* COMMON_PORTABLE */
      */
     int work_stolen;
 
+    /**
+     * Index of the worker this worker last stole from, or -1.  The next
+     * random steal tries this victim first, since a worker that had
+     * stealable work recently is likely to have more.
+     *
+     * [local read/write]
+     */
+    int last_victim;
+
+    /**
+     * Counts of steal attempts, successful steals and idle periods.
+     * Unlike the CILK_PROFILE statistics these are always maintained,
+     * and can be queried at runtime with __cilkrts_get_steal_stats().
+     *
+     * [local write, shared read]
+     */
+    unsigned long long steal_attempts;
+    unsigned long long steals;
+    unsigned long long idles;
+
     /**
      * File pointer for record or replay
      * Does FILE * work on Windows?
@@ -915,10 +915,17 @@ static void random_steal(__cilkrts_worker *w)
        There must be only one worker to prevent stealing. */
     CILK_ASSERT(w->g->total_workers > 1);
 
-    /* pick random *other* victim */
-    n = myrand(w) % (w->g->total_workers - 1);
-    if (n >= w->self)
-        ++n;
+    /* Retry the last victim once if it had work; otherwise pick a random
+       *other* victim. */
+    if (w->l->last_victim >= 0) {
+        n = w->l->last_victim;
+        w->l->last_victim = -1;
+    } else {
+        n = myrand(w) % (w->g->total_workers - 1);
+        if (n >= w->self)
+            ++n;
+    }
+    w->l->steal_attempts++;
 
     // If we're replaying a log, override the victim.  -1 indicates that
     // we've exhausted the list of things this worker stole when we recorded
@@ -1001,6 +1008,8 @@ static void random_steal(__cilkrts_worker *w)
                         success = 1;
                         detach_for_steal(w, victim, fiber);
                         victim_id = victim->self;
+                        w->l->last_victim = victim_id;
+                        w->l->steals++;
 
                         #if REDPAR_DEBUG >= 1
                         fprintf(stderr, "Wkr %d stole from victim %d, fiber = %p\n",
@@ -1794,6 +1803,7 @@ static full_frame* check_for_work(__cilkrts_worker *w)
                 w->l->steal_failure_count % max_fails == max_fails - 1) {
                 // Idle briefly if the worker has never stolen anything for
                 // the given grace period
+                w->l->idles++;
                 __cilkrts_idle();
             } else {
                 __cilkrts_yield();
@@ -2922,6 +2932,10 @@ __cilkrts_worker *make_worker(global_state_t *g,
     w->l->has_stolen = 0;
 
     w->l->work_stolen = 0;
+    w->l->last_victim = -1;
+    w->l->steal_attempts = 0;
+    w->l->steals = 0;
+    w->l->idles = 0;
 
     // Initialize record/replay assuming we're doing neither
     w->l->record_replay_fptr = NULL;
@@ -155,6 +155,11 @@ struct cpp_file_hash_entry
 /* Number of entries to put in a cpp_file_hash_entry pool.  */
 #define FILE_HASH_POOL_SIZE 127
 
+/* Number of bytes of source text per previously unseen identifier that
+   _cpp_stack_file assumes when growing the identifier table.  Typical
+   system headers contain one for every 70 to 200 bytes.  */
+#define BYTES_PER_NEW_IDENTIFIER 128
+
 /* A file hash entry pool.  We allocate cpp_file_hash_entry object from
    one of these.  */
 struct file_hash_entry_pool
@@ -912,6 +917,15 @@ _cpp_stack_file (cpp_reader *pfile, _cpp_file *file, bool import,
 	deps_add_dep (pfile->deps, file->path);
     }
 
+  /* A file seen for the first time is likely to bring in new
+     identifiers.  Size the identifier table for them up front rather
+     than doubling it repeatedly while lexing.  */
+  if (!file->stack_count)
+    ht_reserve (pfile->hash_table,
+		pfile->hash_table->nelements
+		+ (unsigned int) (file->st.st_size
+				  / BYTES_PER_NEW_IDENTIFIER));
+
   /* Clear buffer_valid since _cpp_clean_line messes it up.  */
   file->buffer_valid = false;
   file->stack_count++;
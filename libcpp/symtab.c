@@ -30,7 +30,7 @@ along with this program; see the file COPYING3.  If not see
    existing entry with a potential new one.  */
 
 static unsigned int calc_hash (const unsigned char *, size_t);
-static void ht_expand (cpp_hash_table *);
+static void ht_expand (cpp_hash_table *, unsigned int);
 static double approx_sqrt (double);
 
 /* A deleted entry.  */
@@ -171,20 +171,19 @@ ht_lookup_with_hash (cpp_hash_table *table, const unsigned char *str,
 
   if (++table->nelements * 4 >= table->nslots * 3)
     /* Must expand the string table.  */
-    ht_expand (table);
+    ht_expand (table, table->nslots * 2);
 
   return node;
 }
 
-/* Double the size of a hash table, re-hashing existing entries.  */
+/* Grow a hash table to SIZE slots, re-hashing existing entries.  */
 
 static void
-ht_expand (cpp_hash_table *table)
+ht_expand (cpp_hash_table *table, unsigned int size)
 {
   hashnode *nentries, *p, *limit;
-  unsigned int size, sizemask;
+  unsigned int sizemask;
 
-  size = table->nslots * 2;
   nentries = XCNEWVEC (hashnode, size);
   sizemask = size - 1;
 
@@ -218,6 +217,21 @@ ht_expand (cpp_hash_table *table)
   table->nslots = size;
 }
 
+/* Make room in TABLE for NELEMENTS entries in total, so that inserting
+   them does not expand the table step by step.  */
+
+void
+ht_reserve (cpp_hash_table *table, unsigned int nelements)
+{
+  unsigned int size = table->nslots;
+
+  while ((size_t) nelements * 4 >= (size_t) size * 3 && size < (1U << 30))
+    size *= 2;
+
+  if (size != table->nslots)
+    ht_expand (table, size);
+}
+
 /* For all nodes in TABLE, callback CB with parameters TABLE->PFILE,
    the node, and V.  */
 void
@@ -1,12 +1,35 @@
 /* Public domain.  */
 #include <stddef.h>
 
+typedef unsigned long word_t __attribute__ ((__may_alias__));
+
 int
 memcmp (const void *str1, const void *str2, size_t count)
 {
   const unsigned char *s1 = str1;
   const unsigned char *s2 = str2;
 
+  /* If both pointers can be aligned alike, skip equal words; the byte
+     loop below then determines the result.  */
+  if ((((size_t) s1 ^ (size_t) s2) & (sizeof (word_t) - 1)) == 0)
+    {
+      while (count > 0 && ((size_t) s1 & (sizeof (word_t) - 1)) != 0)
+	{
+	  if (*s1 != *s2)
+	    return *s1 < *s2 ? -1 : 1;
+	  s1++;
+	  s2++;
+	  count--;
+	}
+      while (count >= sizeof (word_t)
+	     && *(const word_t *) s1 == *(const word_t *) s2)
+	{
+	  s1 += sizeof (word_t);
+	  s2 += sizeof (word_t);
+	  count -= sizeof (word_t);
+	}
+    }
+
   while (count-- > 0)
     {
       if (*s1++ != *s2++)
@@ -1,11 +1,29 @@
 /* Public domain.  */
 #include <stddef.h>
 
+typedef unsigned long word_t __attribute__ ((__may_alias__));
+
 void *
 memcpy (void *dest, const void *src, size_t len)
 {
   char *d = dest;
   const char *s = src;
+
+  /* If both pointers can be aligned alike, copy a word at a time.  */
+  if ((((size_t) d ^ (size_t) s) & (sizeof (word_t) - 1)) == 0)
+    {
+      while (len > 0 && ((size_t) d & (sizeof (word_t) - 1)) != 0)
+	{
+	  *d++ = *s++;
+	  len--;
+	}
+      for (; len >= sizeof (word_t); len -= sizeof (word_t))
+	{
+	  *(word_t *) d = *(const word_t *) s;
+	  d += sizeof (word_t);
+	  s += sizeof (word_t);
+	}
+    }
   while (len--)
     *d++ = *s++;
   return dest;
@@ -1,10 +1,33 @@
 /* Public domain.  */
 #include <stddef.h>
 
+typedef unsigned long word_t __attribute__ ((__may_alias__));
+
 void *
 memset (void *dest, int val, size_t len)
 {
   unsigned char *ptr = dest;
+
+  if (len >= 2 * sizeof (word_t))
+    {
+      word_t w = (unsigned char) val;
+      w |= w << 8;
+      w |= w << 16;
+      if (sizeof (word_t) > 4)
+	w |= (w << 16) << 16;
+
+      /* Align, then store a word at a time.  */
+      while (((size_t) ptr & (sizeof (word_t) - 1)) != 0)
+	{
+	  *ptr++ = val;
+	  len--;
+	}
+      for (; len >= sizeof (word_t); len -= sizeof (word_t))
+	{
+	  *(word_t *) ptr = w;
+	  ptr += sizeof (word_t);
+	}
+    }
   while (len-- > 0)
     *ptr++ = val;
   return dest;
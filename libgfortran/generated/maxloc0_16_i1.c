@@ -99,45 +99,70 @@ maxloc0_16_i1 (gfc_array_i16 * const restrict retarray,
 #endif
   while (base)
     {
-      do
+      if (sstride[0] == 1)
 	{
-	  /* Implementation start.  */
-
-#if defined(GFC_INTEGER_1_QUIET_NAN)
+	  /* Contiguous innermost dimension.  Find the maximum of the
+	     row with a loop the vectorizer can handle, and only search
+	     for its position if it improves on maxval.  */
+	  GFC_INTEGER_1 rowval = maxval;
+	  index_type i;
+
+	  for (i = 0; i < extent[0]; i++)
+	    if (base[i] > rowval)
+	      rowval = base[i];
+	  if (rowval > maxval)
+	    {
+	      for (i = 0; base[i] != rowval; i++)
+		;
+	      maxval = rowval;
+	      dest[0] = i + 1;
+	      for (n = 1; n < rank; n++)
+		dest[n * dstride] = count[n] + 1;
+	    }
+	  base += extent[0];
 	}
-      while (0);
-      if (unlikely (!fast))
+      else
 	{
 	  do
 	    {
-	      if (*base >= maxval)
+	      /* Implementation start.  */
+
+#if defined(GFC_INTEGER_1_QUIET_NAN)
+	    }
+	  while (0);
+	  if (unlikely (!fast))
+	    {
+	      do
+		{
+		  if (*base >= maxval)
+		    {
+		      fast = 1;
+		      maxval = *base;
+		      for (n = 0; n < rank; n++)
+			dest[n * dstride] = count[n] + 1;
+		      break;
+		    }
+		  base += sstride[0];
+		}
+	      while (++count[0] != extent[0]);
+	      if (likely (fast))
+		continue;
+	    }
+	  else do
+	    {
+#endif
+	      if (*base > maxval)
 		{
-		  fast = 1;
 		  maxval = *base;
 		  for (n = 0; n < rank; n++)
 		    dest[n * dstride] = count[n] + 1;
-		  break;
 		}
+	      /* Implementation end.  */
+	      /* Advance to the next element.  */
 	      base += sstride[0];
 	    }
 	  while (++count[0] != extent[0]);
-	  if (likely (fast))
-	    continue;
-	}
-      else do
-	{
-#endif
-	  if (*base > maxval)
-	    {
-	      maxval = *base;
-	      for (n = 0; n < rank; n++)
-		dest[n * dstride] = count[n] + 1;
-	    }
-	  /* Implementation end.  */
-	  /* Advance to the next element.  */
-	  base += sstride[0];
 	}
-      while (++count[0] != extent[0]);
       n = 0;
       do
 	{
@@ -515,6 +515,7 @@ typedef struct
 
   int all_unbuffered, unbuffered_preconnected, default_recl;
   int fpe, backtrace;
+  int unformatted_buffer_size, formatted_buffer_size;
 }
 options_t;
 
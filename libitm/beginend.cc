@@ -50,6 +50,11 @@ static _ITM_transactionId_t global_tid;
 static pthread_mutex_t global_tid_lock = PTHREAD_MUTEX_INITIALIZER;
 #endif
 
+#ifdef USE_HTM_FASTPATH
+// Maximum number of times the HTM fastpath waits for serial-mode
+// transactions without counting the wait as a retry.
+static const uint32_t htm_max_serial_waits = 16;
+#endif
 
 // Provides a on-thread-exit callback used to release per-thread data.
 static pthread_key_t thr_release_key;
@@ -203,6 +208,7 @@ GTM::gtm_thread::begin_transaction (uint32_t prop, const gtm_jmpbuf *jb)
       // been chosen in the meantime.  Therefore, take care not not touch
       // anything besides the serial lock, which is independent of method
       // groups.
+      uint32_t serial_waits = 0;
       for (uint32_t t = serial_lock.get_htm_fastpath(); t; t--)
 	{
 	  uint32_t ret = htm_begin();
@@ -250,9 +256,12 @@ GTM::gtm_thread::begin_transaction (uint32_t prop, const gtm_jmpbuf *jb)
 	      // Another thread is running a serial-mode transaction.  Wait.
 	      serial_lock.read_lock(tx);
 	      serial_lock.read_unlock(tx);
-	      // TODO We should probably reset the retry count t here, unless
-	      // we have retried so often that we should go serial to avoid
-	      // starvation.
+	      // An abort caused by a serial-mode transaction says nothing
+	      // about whether this transaction can succeed in HW, so don't
+	      // let it use up the retry budget.  Still go serial eventually
+	      // to avoid starvation if serial-mode transactions are frequent.
+	      if (++serial_waits < htm_max_serial_waits)
+		t++;
 	    }
 	}
     }
@@ -280,7 +289,10 @@ GTM::gtm_thread::begin_transaction (uint32_t prop, const gtm_jmpbuf *jb)
       // other fallback will use serial transactions, which don't use
       // restart_total but will reset it when committing.
       if (!(prop & pr_HTMRetriedAfterAbort))
-	tx->restart_total = gtm_thread::serial_lock.get_htm_fastpath();
+	{
+	  tx->restart_total = gtm_thread::serial_lock.get_htm_fastpath();
+	  tx->htm_serial_waits = 0;
+	}
 
       if (--tx->restart_total > 0)
 	{
@@ -294,6 +306,9 @@ GTM::gtm_thread::begin_transaction (uint32_t prop, const gtm_jmpbuf *jb)
 		goto stop_custom_htm_fastpath;
 	      serial_lock.read_lock(tx);
 	      serial_lock.read_unlock(tx);
+	      // See above.
+	      if (++tx->htm_serial_waits < htm_max_serial_waits)
+		tx->restart_total++;
 	    }
 	  // Let ITM_beginTransaction retry the custom HTM fastpath.
 	  return a_tryHTMFastPath;
@@ -245,6 +245,12 @@ struct gtm_thread
   // restart_total is also used by the HTM fastpath in a different way.
   uint32_t restart_reason[NUM_RESTARTS];
   uint32_t restart_total;
+  // State of the pseudo-random number generator used to randomize the
+  // backoff after restarts due to conflicts.  Zero if not seeded yet.
+  uint32_t backoff_seed;
+  // Number of times the HTM fastpath waited for a serial-mode transaction
+  // while retrying the current transaction (custom HTM fastpath only).
+  uint32_t htm_serial_waits;
 
   // *** The shared part of gtm_thread starts here. ***
   // Shared state is on separate cachelines to avoid false sharing with
@@ -302,6 +308,7 @@ struct gtm_thread
   // In retry.cc
   // Must be called outside of transactions (i.e., after rollback).
   void decide_retry_strategy (gtm_restart_reason);
+  void contention_backoff ();
   abi_dispatch* decide_begin_dispatch (uint32_t prop);
   void number_of_threads_changed(unsigned previous, unsigned now);
   // Must be called from serial mode. Does not call set_abi_disp().
@@ -226,7 +226,21 @@ struct htm_mg : public method_group
     // Enable the HTM fastpath if the HW is available.  The fastpath is
     // initially disabled.
 #ifdef USE_HTM_FASTPATH
-    gtm_thread::serial_lock.set_htm_fastpath(htm_init());
+    uint32_t retries = htm_init();
+    // The number of HW transaction attempts can be tuned via the
+    // environment, but only if the HW is available.
+    const char *env = getenv("ITM_HTM_RETRIES");
+    if (retries && env != NULL)
+      {
+	char *end;
+	unsigned long val = strtoul(env, &end, 10);
+	if (end != env && *end == '\0' && val > 0 && val <= 1000)
+	  retries = val;
+	else
+	  GTM_error("Invalid value in environment variable "
+	      "ITM_HTM_RETRIES\n");
+      }
+    gtm_thread::serial_lock.set_htm_fastpath(retries);
 #endif
   }
   virtual void fini()
@@ -40,6 +40,32 @@ static std::atomic<GTM::abi_dispatch*> default_dispatch;
 // The default TM method as requested by the user, if any.
 static GTM::abi_dispatch* default_dispatch_user = 0;
 
+// The maximum number of times cpu_relax() is called in a single backoff,
+// as a power of two.
+static const uint32_t backoff_max_log = 10;
+
+// Waits for a randomized, exponentially growing amount of time before a
+// transaction that was aborted due to a conflict with another transaction
+// is retried.  Retrying right away would likely run into the same conflict
+// again, so give the other transaction the chance to commit first.
+void
+GTM::gtm_thread::contention_backoff ()
+{
+  uint32_t x = this->backoff_seed;
+  if (x == 0)
+    x = (uint32_t) ((uintptr_t) this >> 6) | 1;
+  // xorshift32.
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  this->backoff_seed = x;
+
+  uint32_t shift = this->restart_total < backoff_max_log
+    ? this->restart_total : backoff_max_log;
+  for (uint32_t spins = x & ((1U << shift) - 1); spins > 0; spins--)
+    cpu_relax ();
+}
+
 void
 GTM::gtm_thread::decide_retry_strategy (gtm_restart_reason r)
 {
@@ -132,6 +158,12 @@ GTM::gtm_thread::decide_retry_strategy (gtm_restart_reason r)
       disp = dispatch_serial();
       set_abi_disp (disp);
     }
+  else if (r == RESTART_LOCKED_READ || r == RESTART_LOCKED_WRITE
+	   || r == RESTART_VALIDATE_READ || r == RESTART_VALIDATE_WRITE
+	   || r == RESTART_VALIDATE_COMMIT)
+    // We will retry with the same TM method, so back off first if we
+    // conflicted with another transaction.
+    contention_backoff ();
 }
 
 
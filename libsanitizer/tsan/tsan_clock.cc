@@ -138,11 +138,15 @@ void ThreadClock::acquire(ClockCache *c, const SyncClock *src) {
   // O(N) acquire.
   CPP_STAT_INC(StatClockAcquireFull);
   nclk_ = max(nclk_, nclk);
-  for (uptr i = 0; i < nclk; i++) {
-    u64 epoch = src->elem(i).epoch;
-    if (clk_[i].epoch < epoch) {
-      clk_[i].epoch = epoch;
-      acquired = true;
+  for (uptr i = 0; i < nclk;) {
+    uptr n;
+    const ClockElem *ce = src->elems(i, &n);
+    for (uptr j = 0; j < n; j++, i++) {
+      u64 epoch = ce[j].epoch;
+      if (clk_[i].epoch < epoch) {
+        clk_[i].epoch = epoch;
+        acquired = true;
+      }
     }
   }
 
@@ -190,16 +194,24 @@ void ThreadClock::release(ClockCache *c, SyncClock *dst) const {
   if (acquired)
     CPP_STAT_INC(StatClockReleaseAcquired);
   // Update dst->clk_.
-  for (uptr i = 0; i < nclk_; i++) {
-    ClockElem &ce = dst->elem(i);
-    ce.epoch = max(ce.epoch, clk_[i].epoch);
-    ce.reused = 0;
+  for (uptr i = 0; i < nclk_;) {
+    uptr n;
+    ClockElem *ce = dst->elems(i, &n);
+    n = min(n, nclk_ - i);
+    for (uptr j = 0; j < n; j++, i++) {
+      ce[j].epoch = max(ce[j].epoch, clk_[i].epoch);
+      ce[j].reused = 0;
+    }
   }
   // Clear 'acquired' flag in the remaining elements.
   if (nclk_ < dst->size_)
     CPP_STAT_INC(StatClockReleaseClearTail);
-  for (uptr i = nclk_; i < dst->size_; i++)
-    dst->elem(i).reused = 0;
+  for (uptr i = nclk_; i < dst->size_;) {
+    uptr n;
+    ClockElem *ce = dst->elems(i, &n);
+    for (uptr j = 0; j < n; j++, i++)
+      ce[j].reused = 0;
+  }
   for (unsigned i = 0; i < kDirtyTids; i++)
     dst->dirty_tids_[i] = kInvalidTid;
   dst->release_store_tid_ = kInvalidTid;
@@ -229,17 +241,22 @@ void ThreadClock::ReleaseStore(ClockCache *c, SyncClock *dst) const {
 
   // O(N) release-store.
   CPP_STAT_INC(StatClockStoreFull);
-  for (uptr i = 0; i < nclk_; i++) {
-    ClockElem &ce = dst->elem(i);
-    ce.epoch = clk_[i].epoch;
-    ce.reused = 0;
+  for (uptr i = 0; i < nclk_;) {
+    uptr n;
+    ClockElem *ce = dst->elems(i, &n);
+    n = min(n, nclk_ - i);
+    for (uptr j = 0; j < n; j++, i++) {
+      ce[j].epoch = clk_[i].epoch;
+      ce[j].reused = 0;
+    }
   }
   // Clear the tail of dst->clk_.
   if (nclk_ < dst->size_) {
-    for (uptr i = nclk_; i < dst->size_; i++) {
-      ClockElem &ce = dst->elem(i);
-      ce.epoch = 0;
-      ce.reused = 0;
+    for (uptr i = nclk_; i < dst->size_;) {
+      uptr n;
+      ClockElem *ce = dst->elems(i, &n);
+      internal_memset(ce, 0, n * sizeof(ce[0]));
+      i += n;
     }
     CPP_STAT_INC(StatClockStoreTail);
   }
@@ -275,8 +292,12 @@ void ThreadClock::UpdateCurrentThread(SyncClock *dst) const {
   }
   // Reset all 'acquired' flags, O(N).
   CPP_STAT_INC(StatClockReleaseSlow);
-  for (uptr i = 0; i < dst->size_; i++)
-    dst->elem(i).reused = 0;
+  for (uptr i = 0; i < dst->size_;) {
+    uptr n;
+    ClockElem *ce = dst->elems(i, &n);
+    for (uptr j = 0; j < n; j++, i++)
+      ce[j].reused = 0;
+  }
   for (unsigned i = 0; i < kDirtyTids; i++)
     dst->dirty_tids_[i] = kInvalidTid;
 }
@@ -411,6 +432,22 @@ ClockElem &SyncClock::elem(unsigned tid) const {
   return cb->clock[tid % ClockBlock::kClockCount];
 }
 
+// Returns a pointer to element i and stores to *n the number of elements
+// that follow it contiguously in the same block (including element i).
+// Used by the O(N) loops to map every second-level block only once.
+ClockElem *SyncClock::elems(uptr i, uptr *n) const {
+  DCHECK_LT(i, size_);
+  if (size_ <= ClockBlock::kClockCount) {
+    *n = size_ - i;
+    return &tab_->clock[i];
+  }
+  uptr off = i % ClockBlock::kClockCount;
+  *n = min(ClockBlock::kClockCount - off, size_ - i);
+  u32 idx = tab_->table[i / ClockBlock::kClockCount];
+  ClockBlock *cb = ctx->clock_alloc.Map(idx);
+  return &cb->clock[off];
+}
+
 void SyncClock::DebugDump(int(*printf)(const char *s, ...)) {
   printf("clock=[");
   for (uptr i = 0; i < size_; i++)
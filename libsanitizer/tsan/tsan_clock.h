@@ -73,6 +73,7 @@ class SyncClock {
   u32 size_;
 
   ClockElem &elem(unsigned tid) const;
+  ClockElem *elems(uptr i, uptr *n) const;
 };
 
 // The clock that lives in threads.
@@ -107,6 +107,10 @@ struct plugin_symtab
   struct sym_aux *aux;
   struct ld_plugin_symbol *syms;
   unsigned long long id;
+  /* Raw symbol table sections.  Symbol names and comdat keys point into
+     these unless the symbol style required a prefix to be added.  */
+  int nsections;
+  char **sections;
 };
 
 /* Encapsulates object file data during symbol scan.  */
@@ -250,7 +254,7 @@ parse_table_entry (char *p, struct ld_plugin_symbol *entry,
 	{
     /* cf. Duff's device.  */
     case ss_none:
-	  entry->name = xstrdup (p);
+	  entry->name = p;
 	  break;
 	}
     /* FALL-THROUGH.  */
@@ -272,10 +276,8 @@ parse_table_entry (char *p, struct ld_plugin_symbol *entry,
     p++;
   p++;
 
-  if (strlen (entry->comdat_key) == 0)
+  if (*entry->comdat_key == '\0')
     entry->comdat_key = NULL;
-  else
-    entry->comdat_key = xstrdup (entry->comdat_key);
 
   t = *p;
   check (t <= 4, LDPL_FATAL, "invalid symbol kind found");
@@ -300,8 +302,26 @@ parse_table_entry (char *p, struct ld_plugin_symbol *entry,
   return p;
 }
 
+/* Return true if the name of symbol S was allocated by parse_table_entry
+   rather than pointing into a symbol table section.  */
+
+static int
+symbol_name_allocated_p (const struct ld_plugin_symbol *s)
+{
+  switch (sym_style)
+    {
+    case ss_uscore:
+      return 1;
+    case ss_win32:
+      return s->name[0] != '@';
+    default:
+      return 0;
+    }
+}
+
 /* Translate the IL symbol table located between DATA and END. Append the
-   slots and symbols to OUT. */
+   slots and symbols to OUT.  DATA must stay live until free_1, since the
+   symbols refer to strings inside it.  */
 
 static void
 translate (char *data, char *end, struct plugin_symtab *out)
@@ -345,11 +365,16 @@ free_1 (struct plugin_file_info *files, unsigned num_files)
       for (j = 0; j < symtab->nsyms; j++)
 	{
 	  struct ld_plugin_symbol *s = &symtab->syms[j];
-	  free (s->name);
-	  free (s->comdat_key);
+	  if (symbol_name_allocated_p (s))
+	    free (s->name);
 	}
       free (symtab->syms);
       symtab->syms = NULL;
+      for (j = 0; j < symtab->nsections; j++)
+	free (symtab->sections[j]);
+      free (symtab->sections);
+      symtab->sections = NULL;
+      symtab->nsections = 0;
     }
 }
 
@@ -932,7 +957,11 @@ process_symtab (void *data, const char *name, off_t offset, off_t length)
 
   translate (secdatastart, secdata, obj->out);
   obj->found++;
-  free (secdatastart);
+  /* The symbols now point into the section data; keep it until free_1.  */
+  obj->out->sections
+    = xrealloc (obj->out->sections,
+		(obj->out->nsections + 1) * sizeof (char *));
+  obj->out->sections[obj->out->nsections++] = secdatastart;
   return 1;
 
 err: